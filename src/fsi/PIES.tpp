@@ -51,6 +51,7 @@ namespace sdc
 
         solver->setNumberOfImplicitStages( k - 1 );
 
+        data->setIntegrationMatrix( qmat );
         data->initialize( k, solver->getDOF() );
     }
 
@@ -75,6 +76,8 @@ namespace sdc
 
         for ( int i = 0; i < dsdc.rows(); i++ )
             dsdc( i ) = nodes( i + 1 ) - nodes( i );
+
+        data->setIntegrationMatrix( qmat );
     }
 
     template<typename precision>
@@ -5,7 +5,7 @@ import os, subprocess, multiprocessing, time, sys, argparse
 nbCores = int( os.environ['WM_NCOMPPROCS'] )
 
 parser = argparse.ArgumentParser( description='Run the test suite' )
-parser.add_argument('testsuite', help='which testsuite: testsuite-dealii, testsuite-rbf, testsuite-spacemapping, testsuite-fsi, or testsuite-sdc' )
+parser.add_argument('testsuite', help='which testsuite: testsuite-allocation, testsuite-dealii, testsuite-rbf, testsuite-spacemapping, testsuite-fsi, or testsuite-sdc' )
 args = parser.parse_args()
 
 runs = []
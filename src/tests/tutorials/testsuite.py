@@ -116,3 +116,42 @@ for tutorial in sorted( os.listdir(".") ):
             if "End" in line: simulationCompleted = True
 
     assert simulationCompleted == True
+
+# Run a decomposed tutorial for two time steps with a radial basis function
+# with a compact support for the mesh motion. The domain is decomposed in the
+# flow direction, and the processor downstream of the beam is outside the
+# support radius of the control points. That processor does not consume the
+# motion of the interface, while the mesh motion is solved several times.
+
+os.chdir( mainDir + "/beamInCrossFlow2D" )
+
+controlDict = ParsedParameterFile( "fluid/system/controlDict" )
+controlDict['endTime'] = 2 * controlDict['deltaT']
+controlDict.writeFile()
+
+dynamicMeshDict = ParsedParameterFile( "fluid/constant/dynamicMeshDict" )
+dynamicMeshDict['fixedPatches'] = ['inlet']
+dynamicMeshDict['interpolation'] = {'function': 'WendlandC2', 'radius': 2}
+dynamicMeshDict.writeFile()
+
+decomposeParDict = ParsedParameterFile( "fluid/system/decomposeParDict" )
+decomposeParDict['method'] = "simple"
+decomposeParDict['simpleCoeffs'] = {'n': "(3 1 1)", 'delta': 0.001}
+decomposeParDict.writeFile()
+
+status = subprocess.call( "./Allrun", shell = True )
+if status != 0: subprocess.call( "cat fluid/log.fsiFoam", shell = True )
+assert status == 0
+
+simulationCompleted = False
+nonConsumerProcs = False
+
+with open( "fluid/log.fsiFoam" ) as f:
+    for line in f:
+        assert "assert" not in line
+        if "Finalising parallel run" in line: simulationCompleted = True
+        if "End" in line: simulationCompleted = True
+        if "Interface communicator:" in line and "3 processors consume" not in line: nonConsumerProcs = True
+
+assert simulationCompleted == True
+assert nonConsumerProcs == True